@@ -6311,6 +6311,10 @@ extract_all_failed_assumptions (void)
       c = var2reason (v);
       if (!c)
 	continue;
+#ifdef NO_BINARY_CLAUSES
+      if (c == &impl)
+	resetimpl ();
+#endif
       eol = end_of_lits (c);
       for (p = c->lits; p < eol; p++)
 	{